@@ -5,14 +5,30 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <iomanip>
 #include <limits>
 #include <algorithm>
 #include <cctype>
+#include <climits>
+#include <deque>
+#include <chrono>
+#include <functional>
+#include <ctime>
+#include <queue>
+#include <unordered_set>
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include <fstream>
 
 using namespace std;
 
 // Euta saman (item) ko details rakhne struct
+// (search result ra display ko lagi matra - inventory bhitra hot/cold ma chuttai basxa)
 struct Item {
     int id;            // Unique ID number
     string name;       // Saman ko naam
@@ -25,79 +41,1669 @@ struct Item {
         : id(itemId), name(itemName), quantity(qty), price(itemPrice), category(cat) {}
 };
 
+// Dherai chalne fields (hot) - ID lookup ra stock update le yei matra chhuncha.
+// Sano ra dense rakheko le eutai cache line ma dherai item aataucha.
+struct ItemHot {
+    int id;            // Unique ID number
+    int quantity;      // Kati ota cha stock ma
+    double price;      // Euta ko price
+};
+
+// Kahile kahi matra chahine fields (cold) - search ra display le matra padhcha
+struct ItemCold {
+    string name;       // Saman ko naam
+    string category;   // Kasto type ko saman ho
+};
+
+// Stock update ko idempotency key haru yaad rakhne table.
+// Key haru time bucket ma basxan; TTL sakiyeko bucket pura ekai choti hatcha,
+// ani key ko satta 64-bit hash matra rakhcha (sano memory).
+class DedupeTable {
+public:
+    // Pahila nai apply bhayeko update ko result
+    struct Result {
+        int itemId;
+        int quantity;    // Update pachhi ko stock
+    };
+
+    DedupeTable(int ttlSeconds = 600, int bucketSeconds = 60)
+        : bucketSeconds(bucketSeconds),
+          bucketCount((ttlSeconds + bucketSeconds - 1) / bucketSeconds) {}
+
+    // Key pahila dekhiyeko bhaye result dincha, nabhaye nullptr
+    const Result* find(const string& key) {
+        expire();
+        size_t h = hash<string>()(key);
+        for (const auto& bucket : buckets) {
+            auto found = bucket.keys.find(h);
+            if (found != bucket.keys.end()) return &found->second;
+        }
+        return nullptr;
+    }
+
+    // Naya key ra tyasko result record garcha (sabai bhanda naya bucket ma)
+    void record(const string& key, int itemId, int quantity) {
+        long long now = currentBucket();
+        if (buckets.empty() || buckets.back().start != now) {
+            buckets.push_back({now, {}});
+        }
+        buckets.back().keys[hash<string>()(key)] = {itemId, quantity};
+    }
+
+private:
+    struct Bucket {
+        long long start;                        // Bucket ko number (time / bucketSeconds)
+        unordered_map<size_t, Result> keys;     // Key ko hash -> result
+    };
+
+    int bucketSeconds;
+    int bucketCount;         // TTL bhitra kati bucket aataucha
+    deque<Bucket> buckets;   // Purano bata naya order ma
+
+    long long currentBucket() const {
+        auto secs = chrono::duration_cast<chrono::seconds>(
+            chrono::steady_clock::now().time_since_epoch()).count();
+        return secs / bucketSeconds;
+    }
+
+    // TTL bhanda purano bucket haru hataucha
+    void expire() {
+        long long oldest = currentBucket() - bucketCount;
+        while (!buckets.empty() && buckets.front().start <= oldest) {
+            buckets.pop_front();
+        }
+    }
+};
+
+// Stock kina badhyo/ghatyo bhanne code (posting ko contra account jasto)
+enum class StockReason : char {
+    Opening,     // Naya saman thapda ko suru stock
+    Receipt,     // Pahila nai bhayeko saman ma thap stock aayo
+    Adjustment,  // Menu bata stock update gareko
+    Removal,     // Saman nai inventory bata hatayo
+    Shipment,    // Serial number sahit pathayeko
+    Assembly,    // Kit build garda component khapeko ra kit baneko
+    Disassembly  // Kit kholda kit ghateko ra component firta aayeko
+};
+
+// Reason code lai padhna milne naam ma badlcha
+const char* reasonName(StockReason reason) {
+    switch (reason) {
+        case StockReason::Opening:    return "Opening";
+        case StockReason::Receipt:    return "Receipt";
+        case StockReason::Adjustment: return "Adjustment";
+        case StockReason::Removal:    return "Removal";
+        case StockReason::Shipment:   return "Shipment";
+        case StockReason::Assembly:   return "Assembly";
+        case StockReason::Disassembly: return "Disassembly";
+    }
+    return "Unknown";
+}
+
+// Yo posting demand (bikri/khapat) ho ki - velocity, safety stock ra replenishment le yei herchha.
+// Bahira gayeko stock demand ho, tara item hataunu ra kit kholnu demand hoina.
+// Kit build garda component khapeko chai demand ho: component kinnu parne karan tyahi ho.
+bool countsAsDemand(StockReason reason, int qty) {
+    return qty < 0 && reason != StockReason::Removal && reason != StockReason::Disassembly;
+}
+
+// Stock ko har change record garne append-only ledger.
+// Column anusar chuttai vector ma rakhcha, ani balance sangai sangai milaucha.
+class StockLedger {
+public:
+    // Euta posting thapcha ra tyo item ko balance update garcha
+    void post(int itemId, int qty, StockReason reason, const string& reference) {
+        itemIds.push_back(itemId);
+        quantities.push_back(qty);
+        reasons.push_back(reason);
+        references.push_back(reference);
+        times.push_back(time(nullptr));
+        balances[itemId] += qty;
+    }
+
+    // Item ko ahile samma ko balance (posting haru bata derive gareko)
+    long long balance(int itemId) const {
+        auto found = balances.find(itemId);
+        return found != balances.end() ? found->second : 0;
+    }
+
+    // Yo item ko kunai posting cha ki chaina
+    bool contains(int itemId) const {
+        return balances.find(itemId) != balances.end();
+    }
+
+    size_t size() const {
+        return itemIds.size();
+    }
+
+    // Sabai posting feri jodera balance nikalcha (verify garna lai)
+    unordered_map<int, long long> recompute() const {
+        unordered_map<int, long long> sums;
+        for (size_t i = 0; i < itemIds.size(); ++i) {
+            sums[itemIds[i]] += quantities[i];
+        }
+        return sums;
+    }
+
+    // Har item ko din anusar ko bikri (outbound qty), pahilo posting ko din dekhi
+    // aaja samma - bikri nabhayeko din 0. Removal lai demand manidaina.
+    unordered_map<int, vector<int>> dailyDemand(time_t now) const {
+        const time_t DAY = 24 * 60 * 60;
+        unordered_map<int, time_t> firstSeen;
+        for (size_t i = 0; i < itemIds.size(); ++i) {
+            firstSeen.emplace(itemIds[i], times[i]);
+        }
+
+        unordered_map<int, vector<int>> demand;
+        for (const auto& entry : firstSeen) {
+            demand[entry.first].assign((now - entry.second) / DAY + 1, 0);
+        }
+        for (size_t i = 0; i < itemIds.size(); ++i) {
+            if (!countsAsDemand(reasons[i], quantities[i])) continue;
+            vector<int>& days = demand[itemIds[i]];
+            size_t day = (times[i] - firstSeen[itemIds[i]]) / DAY;
+            if (day < days.size()) days[day] -= quantities[i];
+        }
+        return demand;
+    }
+
+    // Euta item ko sabai posting dekhaucha
+    void printHistory(int itemId) const {
+        cout << left << setw(12) << "QTY" << setw(12) << "REASON" << "REFERENCE\n";
+        cout << string(40, '-') << "\n";
+        for (size_t i = 0; i < itemIds.size(); ++i) {
+            if (itemIds[i] != itemId) continue;
+            cout << left << setw(12) << quantities[i]
+                 << setw(12) << reasonName(reasons[i])
+                 << references[i] << "\n";
+        }
+    }
+
+private:
+    // Column haru - index i ma euta posting
+    vector<int> itemIds;
+    vector<int> quantities;
+    vector<StockReason> reasons;
+    vector<string> references;
+    vector<time_t> times;
+
+    unordered_map<int, long long> balances;  // ID -> incremental balance
+};
+
+// Euta receipt lot - kati ota ra kati ma kineko
+struct CostLayer {
+    int qty;
+    double unitCost;
+};
+
+// FIFO, LIFO ra weighted average tino method ko cost sangai
+struct CostSet {
+    double fifo = 0, lifo = 0, average = 0;
+};
+
+// Euta item ko cost layer haru ra FIFO/LIFO/weighted average value.
+// Stock aauda layer thapcha, jada layer khapaucha - value haru sangai milaucha,
+// history feri replay garnu pardaina.
+class ItemValuation {
+public:
+    // Naya stock aayo - pahila negative stock (shortfall) bhaye tyo puraucha.
+    // Method anusar farak unit cost huna sakcha (jastai kit ma component ko cost).
+    void receive(int qty, const CostSet& unitCost) {
+        int covered = static_cast<int>(min<long long>(qty, shortfall));
+        shortfall -= covered;
+        qty -= covered;
+        if (qty <= 0) return;
+
+        fifoLayers.push_back({qty, unitCost.fifo});
+        lifoLayers.push_back({qty, unitCost.lifo});
+        fifo += qty * unitCost.fifo;
+        lifo += qty * unitCost.lifo;
+        avgQty += qty;
+        avgValue += qty * unitCost.average;
+    }
+
+    // Stock gayo - FIFO le sabai bhanda purano, LIFO le sabai bhanda naya layer khapaucha.
+    // Method anusar kati cost khapayo return garcha.
+    CostSet issue(int qty) {
+        CostSet consumed;
+        int available = static_cast<int>(avgQty);
+        int taken = min(qty, available);
+        shortfall += qty - taken;
+        if (taken <= 0) return consumed;
+
+        consumed.fifo = consume(fifoLayers, taken, true);
+        consumed.lifo = consume(lifoLayers, taken, false);
+        consumed.average = taken * (avgValue / avgQty);
+        fifo -= consumed.fifo;
+        lifo -= consumed.lifo;
+        avgValue -= consumed.average;
+        avgQty -= taken;
+        if (avgQty == 0) {
+            fifo = lifo = avgValue = 0;  // Rounding ko dhulo saf garcha
+        }
+        return consumed;
+    }
+
+    // Ahile ko weighted average unit cost (layer nabhaye 0)
+    double averageUnitCost() const {
+        return avgQty > 0 ? avgValue / avgQty : 0;
+    }
+
+    double fifoValue() const { return fifo; }
+    double lifoValue() const { return lifo; }
+    double averageValue() const { return avgValue; }
+
+private:
+    deque<CostLayer> fifoLayers;  // Agadi purano, pachhadi naya
+    deque<CostLayer> lifoLayers;
+    double fifo = 0, lifo = 0;
+    long long avgQty = 0;         // Layer ma bhayeko jamma qty
+    double avgValue = 0;
+    long long shortfall = 0;      // Layer bhanda badi bechiyeko qty
+
+    // Layer haru bata qty khapaucha, khapayeko cost return garcha
+    static double consume(deque<CostLayer>& layers, int qty, bool fromFront) {
+        double cost = 0;
+        while (qty > 0 && !layers.empty()) {
+            CostLayer& layer = fromFront ? layers.front() : layers.back();
+            int take = min(qty, layer.qty);
+            cost += take * layer.unitCost;
+            layer.qty -= take;
+            qty -= take;
+            if (layer.qty == 0) {
+                if (fromFront) layers.pop_front(); else layers.pop_back();
+            }
+        }
+        return cost;
+    }
+};
+
+// Euta lot/batch bata kati ota nikaleko
+struct LotPick {
+    string lotCode;
+    time_t expiry;
+    int qty;
+};
+
+// Item anusar lot haru ra tinko expiry date track garcha.
+// Har item ko lot haru min-heap ma (sabai bhanda chado expire hune mathi),
+// ani sabai lot ko global expiry index chuttai - "N din bhitra expire" le pura scan gardaina.
+class LotTracker {
+public:
+    // Naya lot receive garcha
+    void receive(int itemId, const string& lotCode, time_t expiry, int qty) {
+        if (qty <= 0) return;
+        size_t lotId = lots.size();
+        lots.push_back({itemId, lotCode, expiry, qty, byExpiry.emplace(expiry, lotId)});
+        byItem[itemId].push({expiry, lotId});
+    }
+
+    // First-expired-first-out anusar qty nikalcha, kun lot bata kati nikalyo return garcha.
+    // Lot ma bhanda badi magyo bhane baki lot nabhayeko stock bata gayeko manincha.
+    vector<LotPick> allocate(int itemId, int qty) {
+        vector<LotPick> picks;
+        auto found = byItem.find(itemId);
+        if (found == byItem.end()) return picks;
+
+        LotHeap& heap = found->second;
+        while (qty > 0 && !heap.empty()) {
+            LotRecord& lot = lots[heap.top().second];
+            int take = min(qty, lot.qty);
+            picks.push_back({lot.lotCode, lot.expiry, take});
+            lot.qty -= take;
+            qty -= take;
+            if (lot.qty == 0) {
+                byExpiry.erase(lot.indexEntry);
+                heap.pop();
+            }
+        }
+        return picks;
+    }
+
+    // Item hatauda tyasko baki lot haru pani hataucha
+    void removeItem(int itemId) {
+        auto found = byItem.find(itemId);
+        if (found == byItem.end()) return;
+        while (!found->second.empty()) {
+            LotRecord& lot = lots[found->second.top().second];
+            byExpiry.erase(lot.indexEntry);
+            lot.qty = 0;
+            found->second.pop();
+        }
+        byItem.erase(found);
+    }
+
+    // Deadline samma expire hune lot haru (expiry order ma) callback lai dincha
+    void forEachExpiringBy(time_t deadline,
+                           const function<void(int itemId, const LotPick& lot)>& visit) const {
+        for (auto it = byExpiry.begin(); it != byExpiry.end() && it->first <= deadline; ++it) {
+            const LotRecord& lot = lots[it->second];
+            visit(lot.itemId, {lot.lotCode, lot.expiry, lot.qty});
+        }
+    }
+
+private:
+    struct LotRecord {
+        int itemId;
+        string lotCode;
+        time_t expiry;
+        int qty;                                        // Lot ma baki qty
+        multimap<time_t, size_t>::iterator indexEntry;  // byExpiry bhitra ko entry
+    };
+    typedef priority_queue<pair<time_t, size_t>, vector<pair<time_t, size_t>>,
+                           greater<pair<time_t, size_t>>> LotHeap;
+
+    vector<LotRecord> lots;                   // Lot ID -> record
+    unordered_map<int, LotHeap> byItem;       // Item ID -> khali nabhayeko lot haru
+    multimap<time_t, size_t> byExpiry;        // Expiry -> lot ID (khali nabhayeko matra)
+};
+
+const time_t SECONDS_PER_DAY = 24 * 60 * 60;
+const int MAX_EXPIRY_DAYS = 3650;   // Lot expiry ra report window ko mathillo seema (10 barsa)
+
+// time_t lai YYYY-MM-DD ma print garcha
+string formatDate(time_t when) {
+    char buffer[16];
+    strftime(buffer, sizeof(buffer), "%Y-%m-%d", localtime(&when));
+    return buffer;
+}
+
+// Euta item ko stock ma bhayeko serial number haru.
+// Numeric serial haru 4096 ko chunk ma basxan - thorai bhaye sorted array,
+// dherai bhaye bitmap (compressed bitmap jasto). Alphanumeric serial hash set ma.
+class SerialSet {
+public:
+    static const uint64_t MAX_RANGE = 1000000;   // Euta receive/ship ma badhi ma kati serial
+
+    // Leading zero nabhayeko number matra numeric serial manincha ("00123" string nai ho)
+    static bool parseNumeric(const string& text, uint64_t& value) {
+        if (text.empty() || text.size() > 18 || (text.size() > 1 && text[0] == '0')) return false;
+        if (!all_of(text.begin(), text.end(), ::isdigit)) return false;
+        value = stoull(text);
+        return true;
+    }
+
+    bool contains(const string& serial) const {
+        uint64_t value;
+        if (!parseNumeric(serial, value)) return words.count(serial) > 0;
+        auto found = chunks.find(value / CHUNK_BITS);
+        return found != chunks.end() && found->second.test(value % CHUNK_BITS);
+    }
+
+    // Naya thapyo bhane true
+    bool insert(const string& serial) {
+        uint64_t value;
+        if (!parseNumeric(serial, value)) return words.insert(serial).second;
+        return chunks[value / CHUNK_BITS].set(value % CHUNK_BITS);
+    }
+
+    // Thiyo ra hatayo bhane true
+    bool erase(const string& serial) {
+        uint64_t value;
+        if (!parseNumeric(serial, value)) return words.erase(serial) > 0;
+        auto found = chunks.find(value / CHUNK_BITS);
+        if (found == chunks.end() || !found->second.clear(value % CHUNK_BITS)) return false;
+        if (found->second.count == 0) chunks.erase(found);
+        return true;
+    }
+
+    bool empty() const {
+        return chunks.empty() && words.empty();   // Khali chunk turuntai hatincha
+    }
+
+    // first..last (inclusive) sabai thapcha, naya thapeko kati return garcha
+    size_t insertRange(uint64_t first, uint64_t last) {
+        size_t added = 0;
+        for (uint64_t lo = first; lo <= last; ) {
+            uint64_t chunkEnd = (lo / CHUNK_BITS + 1) * CHUNK_BITS - 1;
+            uint64_t hi = min(last, chunkEnd);
+            added += chunks[lo / CHUNK_BITS].setRange(lo % CHUNK_BITS, hi % CHUNK_BITS);
+            if (hi == last) break;
+            lo = hi + 1;
+        }
+        return added;
+    }
+
+    // first..last (inclusive) bhitra ka sabai hataucha, hatayeko kati return garcha
+    // (range bhitra ka bhayeka chunk matra chhuncha - range jati thulo bhaye pani)
+    size_t eraseRange(uint64_t first, uint64_t last) {
+        uint64_t firstChunk = first / CHUNK_BITS, lastChunk = last / CHUNK_BITS;
+        vector<uint64_t> touched;
+        if (lastChunk - firstChunk >= chunks.size()) {
+            for (const auto& entry : chunks) {
+                if (entry.first >= firstChunk && entry.first <= lastChunk) touched.push_back(entry.first);
+            }
+        } else {
+            for (uint64_t c = firstChunk; c <= lastChunk; ++c) {
+                if (chunks.count(c)) touched.push_back(c);
+            }
+        }
+
+        size_t removed = 0;
+        for (uint64_t c : touched) {
+            Chunk& chunk = chunks[c];
+            uint64_t lo = c == firstChunk ? first % CHUNK_BITS : 0;
+            uint64_t hi = c == lastChunk ? last % CHUNK_BITS : CHUNK_BITS - 1;
+            removed += chunk.clearRange(lo, hi);
+            if (chunk.count == 0) chunks.erase(c);
+        }
+        return removed;
+    }
+
+private:
+    static const uint64_t CHUNK_BITS = 4096;
+    static const size_t SPARSE_LIMIT = 256;   // Yo bhanda badi bhaye bitmap ma badlcha
+
+    // 4096 ota serial ko euta chunk - sparse (sorted offsets) wa bitmap
+    struct Chunk {
+        vector<uint16_t> sparse;
+        vector<uint64_t> bits;    // Khali bhaye sparse mode ma cha
+        size_t count = 0;
+
+        bool test(uint64_t offset) const {
+            if (!bits.empty()) return (bits[offset / 64] >> (offset % 64)) & 1;
+            return binary_search(sparse.begin(), sparse.end(), static_cast<uint16_t>(offset));
+        }
+
+        bool set(uint64_t offset) {
+            if (!bits.empty()) {
+                uint64_t mask = uint64_t(1) << (offset % 64);
+                if (bits[offset / 64] & mask) return false;
+                bits[offset / 64] |= mask;
+                ++count;
+                return true;
+            }
+            auto pos = lower_bound(sparse.begin(), sparse.end(), static_cast<uint16_t>(offset));
+            if (pos != sparse.end() && *pos == offset) return false;
+            sparse.insert(pos, static_cast<uint16_t>(offset));
+            ++count;
+            if (sparse.size() > SPARSE_LIMIT) toBitmap();
+            return true;
+        }
+
+        bool clear(uint64_t offset) {
+            if (!bits.empty()) {
+                uint64_t mask = uint64_t(1) << (offset % 64);
+                if (!(bits[offset / 64] & mask)) return false;
+                bits[offset / 64] &= ~mask;
+                --count;
+                return true;
+            }
+            auto pos = lower_bound(sparse.begin(), sparse.end(), static_cast<uint16_t>(offset));
+            if (pos == sparse.end() || *pos != offset) return false;
+            sparse.erase(pos);
+            --count;
+            return true;
+        }
+
+        // lo..hi (inclusive) word-by-word set garcha
+        size_t setRange(uint64_t lo, uint64_t hi) {
+            toBitmap();
+            size_t before = count;
+            for (uint64_t word = lo / 64; word <= hi / 64; ++word) {
+                uint64_t updated = bits[word] | rangeMask(word, lo, hi);
+                count += bitset<64>(updated).count() - bitset<64>(bits[word]).count();
+                bits[word] = updated;
+            }
+            return count - before;
+        }
+
+        size_t clearRange(uint64_t lo, uint64_t hi) {
+            size_t before = count;
+            if (bits.empty()) {
+                auto from = lower_bound(sparse.begin(), sparse.end(), static_cast<uint16_t>(lo));
+                auto to = upper_bound(sparse.begin(), sparse.end(), static_cast<uint16_t>(hi));
+                count -= to - from;
+                sparse.erase(from, to);
+                return before - count;
+            }
+            for (uint64_t word = lo / 64; word <= hi / 64; ++word) {
+                uint64_t updated = bits[word] & ~rangeMask(word, lo, hi);
+                count -= bitset<64>(bits[word]).count() - bitset<64>(updated).count();
+                bits[word] = updated;
+            }
+            return before - count;
+        }
+
+        void toBitmap() {
+            if (!bits.empty()) return;
+            bits.assign(CHUNK_BITS / 64, 0);
+            for (uint16_t offset : sparse) bits[offset / 64] |= uint64_t(1) << (offset % 64);
+            sparse.clear();
+            sparse.shrink_to_fit();
+        }
+
+        // Word bhitra lo..hi ma pareko bit haru ko mask
+        static uint64_t rangeMask(uint64_t word, uint64_t lo, uint64_t hi) {
+            uint64_t first = max(lo, word * 64) % 64;
+            uint64_t last = min(hi, word * 64 + 63) % 64;
+            uint64_t upper = last == 63 ? ~uint64_t(0) : (uint64_t(1) << (last + 1)) - 1;
+            return upper & ~((uint64_t(1) << first) - 1);
+        }
+    };
+
+    unordered_map<uint64_t, Chunk> chunks;   // Serial / 4096 -> chunk
+    unordered_set<string> words;             // Alphanumeric serial haru
+};
+
+// Kit (bundle) haru kun kun component bata bancha bhanne definition.
+// Multi-level explosion (kit lai leaf component samma kholne) cache ma rakhcha,
+// BOM badlida matra cache fyalcha.
+class BillOfMaterials {
+public:
+    typedef vector<pair<int, int>> ComponentList;   // (component ID, kati ota)
+
+    // Kit ma component thapcha (pahila nai bhaye qty badlcha).
+    // Cycle banne bhaye (kit afnai component huna khojyo) false return garcha.
+    bool setComponent(int kitId, int componentId, int qty) {
+        if (contains(componentId, kitId)) {
+            return false;
+        }
+
+        ComponentList& list = components[kitId];
+        auto existing = find_if(list.begin(), list.end(),
+            [componentId](const pair<int, int>& c) { return c.first == componentId; });
+        if (existing != list.end()) {
+            existing->second = qty;
+        } else {
+            list.push_back({componentId, qty});
+            usedIn[componentId].push_back(kitId);
+        }
+        explosions.clear();
+        return true;
+    }
+
+    bool isKit(int itemId) const {
+        return components.find(itemId) != components.end();
+    }
+
+    const ComponentList& componentsOf(int kitId) const {
+        static const ComponentList none;
+        auto found = components.find(kitId);
+        return found != components.end() ? found->second : none;
+    }
+
+    // Yo item kun kun kit ma component cha
+    const vector<int>& kitsUsing(int componentId) const {
+        static const vector<int> none;
+        auto found = usedIn.find(componentId);
+        return found != usedIn.end() ? found->second : none;
+    }
+
+    // Euta kit ko lagi chahine leaf component haru (sub-kit haru kholera).
+    // Sub-kit pahila explode huncha (topological order), result cache ma basxa.
+    const map<int, long long>& explode(int itemId) const {
+        auto cached = explosions.find(itemId);
+        if (cached != explosions.end()) return cached->second;
+
+        map<int, long long> leaves;
+        auto found = components.find(itemId);
+        if (found != components.end()) {
+            for (const auto& component : found->second) {
+                if (isKit(component.first)) {
+                    for (const auto& leaf : explode(component.first)) {
+                        leaves[leaf.first] += leaf.second * component.second;
+                    }
+                } else {
+                    leaves[component.first] += component.second;
+                }
+            }
+        }
+        return explosions[itemId] = leaves;
+    }
+
+    // itemId afai targetId ho wa tyasko kunai level ma targetId cha ki
+    bool contains(int itemId, int targetId) const {
+        if (itemId == targetId) return true;
+        for (const auto& component : componentsOf(itemId)) {
+            if (contains(component.first, targetId)) return true;
+        }
+        return false;
+    }
+
+    // Kit hatauda tyasko definition hataucha. Aru kit ko recipe chhudaina -
+    // kunai kit ko component rahunjel item hatauna didaina (Inventory::removeItem le herchha).
+    void removeKit(int kitId) {
+        for (const auto& component : componentsOf(kitId)) {
+            vector<int>& kits = usedIn[component.first];
+            kits.erase(remove(kits.begin(), kits.end(), kitId), kits.end());
+            if (kits.empty()) usedIn.erase(component.first);
+        }
+        components.erase(kitId);
+        explosions.clear();
+    }
+
+private:
+    unordered_map<int, ComponentList> components;   // Kit ID -> direct component haru
+    unordered_map<int, vector<int>> usedIn;         // Component ID -> kit haru
+    mutable unordered_map<int, map<int, long long>> explosions;  // Kit ID -> leaf qty (cache)
+};
+
+// Euta item ko safety stock simulation ko result
+struct SafetyStockResult {
+    int itemId;
+    double meanDailyDemand;
+    double safetyStock;
+    double reorderPoint;
+};
+
+// Monte Carlo le safety stock ra reorder point nikalne engine.
+// Har scenario ma lead time random chhanincha, ani tyati din ko demand
+// item ko afnai daily history bata bootstrap garera jodincha.
+// Item haru sabai core ma bandincha - khali bhayeko thread le arko item tancha.
+const double MAX_LEAD_DAYS = 365.0;   // Supplier lead time ko mathillo seema (simulation loop yati din samma)
+
+class SafetyStockSimulator {
+public:
+    SafetyStockSimulator(double meanLeadDays, double serviceLevel, int scenarios = 5000)
+        : meanLeadDays(min(max(meanLeadDays, 1.0), MAX_LEAD_DAYS)),
+          serviceLevel(serviceLevel), scenarios(scenarios) {}
+
+    vector<SafetyStockResult> run(const vector<pair<int, vector<int>>>& histories) const {
+        vector<SafetyStockResult> results(histories.size());
+        atomic<size_t> next(0);
+
+        auto worker = [&]() {
+            for (size_t i = next++; i < histories.size(); i = next++) {
+                results[i] = simulate(histories[i].first, histories[i].second);
+            }
+        };
+
+        unsigned threadCount = max(1u, thread::hardware_concurrency());
+        threadCount = min<unsigned>(threadCount, static_cast<unsigned>(histories.size()));
+        vector<thread> threads;
+        for (unsigned t = 1; t < threadCount; ++t) threads.emplace_back(worker);
+        worker();
+        for (auto& t : threads) t.join();
+        return results;
+    }
+
+private:
+    double meanLeadDays;
+    double serviceLevel;   // 0.95 = 95% scenario ma stockout hudaina
+    int scenarios;
+
+    SafetyStockResult simulate(int itemId, const vector<int>& history) const {
+        double mean = 0;
+        for (int d : history) mean += d;
+        mean = history.empty() ? 0 : mean / history.size();
+
+        // Lead time: mean ko aaspaas Poisson, kam se kam 1 din
+        mt19937 rng(static_cast<unsigned>(itemId) * 2654435761u);
+        poisson_distribution<int> leadTime(meanLeadDays);
+        uniform_int_distribution<size_t> pickDay(0, history.empty() ? 0 : history.size() - 1);
+
+        // Random number haru batch ma pahila nai banaucha, pachhi loop le padhcha matra
+        vector<int> leads(scenarios);
+        for (int& lead : leads) lead = max(1, leadTime(rng));
+
+        vector<double> leadDemand(scenarios, 0);
+        if (!history.empty()) {
+            for (int s = 0; s < scenarios; ++s) {
+                long long total = 0;
+                for (int day = 0; day < leads[s]; ++day) total += history[pickDay(rng)];
+                leadDemand[s] = static_cast<double>(total);
+            }
+        }
+
+        size_t rank = min(leadDemand.size() - 1,
+                          static_cast<size_t>(ceil(serviceLevel * leadDemand.size())) - 1);
+        nth_element(leadDemand.begin(), leadDemand.begin() + rank, leadDemand.end());
+        double reorderPoint = leadDemand[rank];
+        return {itemId, mean, max(0.0, reorderPoint - mean * meanLeadDays), reorderPoint};
+    }
+};
+
+// CSV field lai quote ma halcha, bhitra ko " lai "" banaucha
+string csvQuote(const string& text) {
+    string quoted = "\"";
+    for (char c : text) {
+        if (c == '"') quoted += '"';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+// Pura catalog ko replenishment plan - column anusar, index i ma euta item
+struct ReplenishmentPlan {
+    vector<double> eoq;        // Economic order quantity
+    vector<double> minLevel;   // Yo bhanda tala jharyo bhane order garne
+    vector<double> maxLevel;   // Order garda yaha samma bharne
+    vector<int> orderQty;      // Ahile order garnuparne qty (0 = chaidaina)
+};
+
+// Quantity, price ra demand rate ko column bata EOQ ra min/max nikalcha.
+// Har kernel euta saral loop ho (branch kam) - compiler le vectorize garna sakcha.
+ReplenishmentPlan planReplenishment(const vector<int>& quantity, const vector<double>& price,
+                                    const vector<double>& dailyDemand, double leadDays,
+                                    double orderCost, double holdingRate) {
+    size_t n = quantity.size();
+    ReplenishmentPlan plan;
+    plan.eoq.resize(n);
+    plan.minLevel.resize(n);
+    plan.maxLevel.resize(n);
+    plan.orderQty.resize(n);
+
+    // EOQ = sqrt(2 * barsik demand * order cost / (holding rate * price))
+    // Price 0 bhayeko item ko holding cost hudaina, EOQ ko artha chaina - 0 rakhcha
+    for (size_t i = 0; i < n; ++i) {
+        double holding = holdingRate * price[i];
+        plan.eoq[i] = holding > 0 ? sqrt(2.0 * dailyDemand[i] * 365.0 * orderCost / holding) : 0;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        plan.minLevel[i] = dailyDemand[i] * leadDays;
+        plan.maxLevel[i] = plan.minLevel[i] + plan.eoq[i];
+    }
+    for (size_t i = 0; i < n; ++i) {
+        double gap = plan.maxLevel[i] - quantity[i];
+        bool below = quantity[i] <= plan.minLevel[i] && dailyDemand[i] > 0 && price[i] > 0;
+        plan.orderQty[i] = below ? static_cast<int>(min(ceil(gap), static_cast<double>(INT_MAX))) : 0;
+    }
+    return plan;
+}
+
+// Exponentially decay hune counter - "din ko kati bikyo" history nabhari nikalcha.
+// Decay lazily huncha: update/read garda matra pachhillo time dekhi ko decay lagaucha.
+struct DecayedRate {
+    static constexpr double HALF_LIFE_DAYS = 7.0;
+
+    double level = 0;      // Decay bhayeko jamma qty
+    time_t updated = 0;    // level kahile samma ko decay sahit cha
+
+    void add(int qty, time_t now) {
+        level = at(now) + qty;
+        updated = now;
+    }
+
+    // now samma decay gareko level
+    double at(time_t now) const {
+        if (level == 0 || now <= updated) return level;
+        double days = (now - updated) / (24.0 * 60 * 60);
+        return level * exp2(-days / HALF_LIFE_DAYS);
+    }
+
+    // Units per day: steady state ma level = rate / lambda
+    double perDay(time_t now) const {
+        return at(now) * log(2.0) / HALF_LIFE_DAYS;
+    }
+};
+
+// Item ID haru kati choti access bhayo bhanne approximate count (Count-Min Sketch).
+// Fixed memory - jati sukai item bhaye pani, estimate kahile pani kam hudaina.
+class CountMinSketch {
+public:
+    void add(int key) {
+        for (int row = 0; row < DEPTH; ++row) ++counts[row][slot(key, row)];
+    }
+
+    uint32_t estimate(int key) const {
+        uint32_t best = UINT32_MAX;
+        for (int row = 0; row < DEPTH; ++row) best = min(best, counts[row][slot(key, row)]);
+        return best;
+    }
+
+private:
+    static const int DEPTH = 4;
+    static const int WIDTH = 1024;
+    uint32_t counts[DEPTH][WIDTH] = {};
+
+    // Row anusar farak seed ko multiply-shift hash
+    static size_t slot(int key, int row) {
+        static const uint64_t seeds[DEPTH] = {
+            0x9E3779B97F4A7C15ull, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull, 0xD6E8FEB86659FD93ull
+        };
+        uint64_t h = (static_cast<uint64_t>(static_cast<uint32_t>(key)) + 1) * seeds[row];
+        return (h >> 32) % WIDTH;
+    }
+};
+
+// Sabai bhanda dherai access hune item haru (Space-Saving algorithm).
+// Capacity jati matra entry rakhcha; naya key aauda sabai bhanda sano entry lai bistapit garcha.
+class HeavyHitters {
+public:
+    struct Entry {
+        int key;
+        uint64_t count;   // Mathillo seema
+        uint64_t error;   // count - error = pakka bhayeko minimum
+    };
+
+    explicit HeavyHitters(size_t capacity = 16) : capacity(capacity) {}
+
+    void add(int key) {
+        auto found = find_if(entries.begin(), entries.end(),
+            [key](const Entry& e) { return e.key == key; });
+        if (found != entries.end()) {
+            ++found->count;
+        } else if (entries.size() < capacity) {
+            entries.push_back({key, 1, 0});
+        } else {
+            auto smallest = min_element(entries.begin(), entries.end(),
+                [](const Entry& a, const Entry& b) { return a.count < b.count; });
+            *smallest = {key, smallest->count + 1, smallest->count};
+        }
+    }
+
+    // Count anusar thulo dekhi sano
+    vector<Entry> top(size_t k) const {
+        vector<Entry> sorted = entries;
+        sort(sorted.begin(), sorted.end(),
+            [](const Entry& a, const Entry& b) { return a.count > b.count; });
+        if (sorted.size() > k) sorted.resize(k);
+        return sorted;
+    }
+
+private:
+    size_t capacity;
+    vector<Entry> entries;
+};
+
+// 64-bit key haru ko LSD radix sort (16 bit ko digit), sano dekhi thulo order ma index dincha.
+// Sabai key ma 0 bhayeko mathi ko digit haru ko pass chhodcha.
+vector<size_t> radixSortIndices(const vector<uint64_t>& keys) {
+    vector<size_t> order(keys.size()), scratch(keys.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+
+    uint64_t largest = keys.empty() ? 0 : *max_element(keys.begin(), keys.end());
+    for (int shift = 0; shift < 64 && (largest >> shift) != 0; shift += 16) {
+        vector<size_t> offsets(65536 + 1, 0);
+        for (uint64_t key : keys) ++offsets[((key >> shift) & 0xFFFF) + 1];
+        for (size_t d = 1; d < offsets.size(); ++d) offsets[d] += offsets[d - 1];  // Prefix sum
+        for (size_t idx : order) scratch[offsets[(keys[idx] >> shift) & 0xFFFF]++] = idx;
+        order.swap(scratch);
+    }
+    return order;
+}
+
+const int MAX_STOCK_CHANGE = 1000000;   // Euta stock update ma badhi ma kati thapne/ghataune
+
 // Saman haru lai manage garne class
 class Inventory {
 private:
-    vector<Item> items;  // Sabai saman haru yaha store huncha
-    int nextId = 1;      // Aarko naya ID k hune bhanera track garcha
+    // hot[i] ra cold[i] eutai saman ko ho - duitai sangai thapne/hataune
+    vector<ItemHot> hot;    // id, quantity, price - dense array
+    vector<ItemCold> cold;  // name, category - side table
+    unordered_map<int, size_t> idIndex;  // ID -> hot/cold ko index
+    int nextId = 1;         // Aarko naya ID k hune bhanera track garcha
+    DedupeTable applied;    // Idempotency key bhayeko stock update haru
+    StockLedger ledger;     // Stock ko har change ko record
+    unordered_map<int, ItemValuation> valuations;  // ID -> cost layers
+    double totalFifo = 0, totalLifo = 0, totalAverage = 0;  // Pura inventory ko value
+    vector<char> abcClass;  // hot[i] ko A/B/C class
+    double abcBaseValue = 0;  // Pachhillo classification ko bela ko jamma value
+    double abcDrift = 0;      // Tyo pachhi value kati badlyo
+    vector<DecayedRate> velocity;  // hot[i] ko bikri ko decayed rate
+    CountMinSketch accessSketch;   // ID anusar lookup/update kati choti bhayo
+    HeavyHitters hotItems;         // Sabai bhanda dherai chalne item haru
+    uint64_t accessCount = 0;
+    LotTracker lots;        // Perishable saman ko lot ra expiry
+    unordered_map<int, SerialSet> serials;  // ID -> stock ma bhayeko serial number
+    BillOfMaterials bom;    // Kit ra tinka component haru
+    unordered_map<int, int> buildable;  // Kit ID -> ahile ko stock le kati banna sakcha
+
+    // Stock update wa ID le khojeko item lai traffic stats ma gancha
+    // (naam/category/class search ko match haru ganidaina - dherai item ekai choti match huncha)
+    void recordAccess(int itemId) {
+        accessSketch.add(itemId);
+        hotItems.add(itemId);
+        ++accessCount;
+    }
+
+    // Stock ko change ledger ma lekhcha ra valuation milaucha.
+    // Badheko stock unitCost ma naya layer banchha, ghateko le layer khapaucha.
+    CostSet postMovement(int itemId, int qty, StockReason reason, const string& reference,
+                         double unitCost) {
+        CostSet perMethod;
+        perMethod.fifo = perMethod.lifo = perMethod.average = unitCost;
+        return postMovement(itemId, qty, reason, reference, perMethod);
+    }
+
+    // Mathi ko jastai, tara method anusar chuttai unit cost - khapayeko cost return garcha
+    CostSet postMovement(int itemId, int qty, StockReason reason, const string& reference,
+                         const CostSet& unitCost) {
+        ledger.post(itemId, qty, reason, reference);
+        if (reason != StockReason::Removal) {
+            recordAccess(itemId);
+        }
+
+        // Demand le bikri ko rate badhaucha (item hataunu ra kit kholnu bikri hoina)
+        if (countsAsDemand(reason, qty)) {
+            size_t idx = findItem(itemId);
+            if (idx != npos) velocity[idx].add(-qty, time(nullptr));
+        }
+
+        if (qty < 0 && reason != StockReason::Removal) {
+            // Jun bato bata stock gaye pani sabai bhanda chado expire hune lot bata nikalcha
+            for (const auto& pick : lots.allocate(itemId, -qty)) {
+                cout << "Picked " << pick.qty << " from lot " << pick.lotCode
+                     << " (expires " << formatDate(pick.expiry) << ")\n";
+            }
+        }
+
+        ItemValuation& valuation = valuations[itemId];
+        totalFifo -= valuation.fifoValue();
+        totalLifo -= valuation.lifoValue();
+        totalAverage -= valuation.averageValue();
+        CostSet consumed;
+        if (qty > 0) {
+            valuation.receive(qty, unitCost);
+        } else if (qty < 0) {
+            consumed = valuation.issue(-qty);
+        }
+        totalFifo += valuation.fifoValue();
+        totalLifo += valuation.lifoValue();
+        totalAverage += valuation.averageValue();
+
+        // Yo item component bhayeko kit haru kati banna sakcha feri hisab garcha
+        for (int kitId : bom.kitsUsing(itemId)) {
+            refreshBuildable(kitId);
+        }
+
+        // Value (quantity * price) dherai badlisakyo bhane ABC class feri nikalcha
+        size_t idx = findItem(itemId);
+        if (idx != npos) {
+            abcDrift += fabs(qty * hot[idx].price);
+        }
+        if (abcDrift > ABC_DRIFT_LIMIT * abcBaseValue) {
+            classifyAbc();
+        }
+        return consumed;
+    }
+
+    static constexpr double ABC_DRIFT_LIMIT = 0.05;  // Jamma value ko 5% badlyo bhane reclassify
+
+    // quantity * price (cent ma) le thulo dekhi sano sort garera,
+    // cumulative value ko 80% samma A, 95% samma B, baki C
+    void classifyAbc() {
+        vector<uint64_t> cents(hot.size());
+        for (size_t i = 0; i < hot.size(); ++i) {
+            cents[i] = static_cast<uint64_t>(llround(max(hot[i].quantity, 0) * hot[i].price * 100));
+        }
+        vector<size_t> order = radixSortIndices(cents);
+
+        uint64_t total = 0;
+        for (uint64_t c : cents) total += c;
+
+        uint64_t running = 0;
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            // Yo item bhanda agadi ko cumulative share le class decide garcha
+            double shareBefore = total ? static_cast<double>(running) / total : 1.0;
+            abcClass[*it] = shareBefore < 0.80 ? 'A' : shareBefore < 0.95 ? 'B' : 'C';
+            running += cents[*it];
+        }
+
+        abcBaseValue = total / 100.0;
+        abcDrift = 0;
+    }
+
+    // Item ko quantity badlera movement post garcha, khapayeko cost return garcha
+    CostSet applyMovement(size_t idx, int qty, StockReason reason, const string& reference,
+                          const CostSet& unitCost = CostSet()) {
+        hot[idx].quantity += qty;
+        return postMovement(hot[idx].id, qty, reason, reference, unitCost);
+    }
+
+    // Direct component ko stock herera kit kati ota build garna sakincha
+    void refreshBuildable(int kitId) {
+        const BillOfMaterials::ComponentList& list = bom.componentsOf(kitId);
+        if (list.empty()) {
+            buildable.erase(kitId);
+            return;
+        }
+        int most = INT_MAX;
+        for (const auto& component : list) {
+            size_t idx = findItem(component.first);
+            int onHand = idx != npos ? max(hot[idx].quantity, 0) : 0;
+            most = min(most, onHand / component.second);
+        }
+        buildable[kitId] = most;
+    }
+
+    static const size_t npos = static_cast<size_t>(-1);
     
-    // ID accordingly saman khojne, payena bhane end() return garcha
-    vector<Item>::iterator findItem(int id) {
-        return find_if(items.begin(), items.end(), 
-            [id](const Item& i) { 
-                return i.id == id; 
-            });
+    // ID accordingly saman ko index khojne, payena bhane npos return garcha
+    // (hash index bata O(1) ma - pura array scan gardaina)
+    size_t findItem(int id) const {
+        auto found = idIndex.find(id);
+        return found != idIndex.end() ? found->second : npos;
+    }
+
+    // Index bata pura Item banaucha (display/search ko lagi)
+    Item itemAt(size_t idx) const {
+        return Item(hot[idx].id, cold[idx].name, hot[idx].quantity, hot[idx].price, cold[idx].category);
     }
 
 public:
     // Naya saman inventory ma thapne function
-    void addItem(string name, int qty, double price, string cat = "General") {
+    // Item ko ID return garcha (galti bhaye 0)
+    int addItem(string name, int qty, double price, string cat = "General") {
         // Negative quantity ra price check garcha
         if (qty < 0 || price < 0) {
             cout << "Error: Can't have negative quantities or prices!\n";
-            return;
+            return 0;
         }
         
         // Pahila nai yo item cha ki check garcha (naam herera)
-        auto existing = find_if(items.begin(), items.end(), 
-            [&name](const Item& i) { 
-                return i.name == name; 
+        auto existing = find_if(cold.begin(), cold.end(), 
+            [&name](const ItemCold& c) { 
+                return c.name == name; 
             });
             
-        if (existing != items.end()) {
+        if (existing != cold.end()) {
             // Pahila nai cha, quantity matra update garcha
             cout << "Found existing item - adding to stock...\n";
-            existing->quantity += qty;
-            return;
+            ItemHot& item = hot[existing - cold.begin()];
+            item.quantity += qty;
+            postMovement(item.id, qty, StockReason::Receipt, "", price);
+            return item.id;
         }
         
         // Naya ID diyera naya saman thapcha
         int newId = nextId++;
-        items.emplace_back(newId, name, qty, price, cat);
+        idIndex[newId] = hot.size();
+        hot.push_back({newId, qty, price});
+        abcClass.push_back('C');  // Value nabhayeko naya item C bata suru huncha
+        velocity.emplace_back();
+        cold.push_back({name, cat});
+        postMovement(newId, qty, StockReason::Opening, "", price);
         cout << "Added new item: " << name << " (ID: " << newId << ")\n";
+        return newId;
     }
 
     // ID diyera saman hataune
     void removeItem(int id) {
-        auto itemToRemove = findItem(id);
-        if (itemToRemove != items.end()) {
-            string itemName = itemToRemove->name;
-            items.erase(itemToRemove);
+        size_t idx = findItem(id);
+        if (idx != npos) {
+            // Kit ko component bhaye hataudaina - kit ko recipe chupchap badlinu hudaina
+            const vector<int>& kits = bom.kitsUsing(id);
+            if (!kits.empty()) {
+                cout << "Can't remove " << cold[idx].name << " - it is a component of:\n";
+                for (int kitId : kits) {
+                    size_t kitIdx = findItem(kitId);
+                    cout << "  " << (kitIdx != npos ? cold[kitIdx].name : string("?"))
+                         << " (ID: " << kitId << ")\n";
+                }
+                cout << "Remove those kits first.\n";
+                return;
+            }
+
+            string itemName = cold[idx].name;
+            int remaining = hot[idx].quantity;
+            hot[idx].quantity = 0;   // Posting bhitra ko hisab ma yo item ko value nagancha
+            postMovement(id, -remaining, StockReason::Removal, "", hot[idx].price);
+            valuations.erase(id);
+            lots.removeItem(id);
+            serials.erase(id);
+            buildable.erase(id);
+            bom.removeKit(id);
+            hot.erase(hot.begin() + idx);
+            abcClass.erase(abcClass.begin() + idx);
+            velocity.erase(velocity.begin() + idx);
+            cold.erase(cold.begin() + idx);
+
+            // Hateko bhanda pachhi ka saman ek thau agadi sare, index milaucha
+            idIndex.erase(id);
+            for (size_t i = idx; i < hot.size(); ++i) {
+                idIndex[hot[i].id] = i;
+            }
+
+            // Baki item haru ko share badlyo, ABC class feri nikalcha
+            classifyAbc();
             cout << "Successfully removed: " << itemName << "\n";
         } else {
             cout << "Oops! Couldn't find an item with ID " << id << "\n";
         }
     }
 
-    // Stock ko quantity update garna
-    void updateStock(int itemId, int amount) {
-        auto item = findItem(itemId);
-        if (item != items.end()) {
-            item->quantity += amount;
+    // Stock ko quantity update garna, apply bhayo bhane true return garcha
+    // idempotencyKey diyeko bhaye, eutai key ko dosro update apply gardaina
+    // (scanner le timeout pachhi retry garda double count nahos bhanera).
+    // reference (PO number, note) ledger ma matra jancha - duplicate check ma hoina.
+    bool updateStock(int itemId, int amount, const string& idempotencyKey = "",
+                     const string& reference = "") {
+        // Range bahira ko amount (jastai INT_MIN) lai negate garda overflow huncha
+        if (amount < -MAX_STOCK_CHANGE || amount > MAX_STOCK_CHANGE) {
+            cout << "Error: A stock change must be between " << -MAX_STOCK_CHANGE
+                 << " and " << MAX_STOCK_CHANGE << "!\n";
+            return false;
+        }
+
+        if (!idempotencyKey.empty()) {
+            if (const DedupeTable::Result* previous = applied.find(idempotencyKey)) {
+                cout << "Already applied (key " << idempotencyKey << ") - item "
+                     << previous->itemId << " has " << previous->quantity << " in stock.\n";
+                return false;
+            }
+        }
+
+        size_t idx = findItem(itemId);
+        if (idx != npos) {
+            // Serial bhayeko stock serial sangai pathaunu parcha, natra pachhi feri ghatcha
+            auto tracked = serials.find(itemId);
+            if (amount < 0 && tracked != serials.end() && !tracked->second.empty()) {
+                cout << "Error: " << cold[idx].name << " is serial-tracked - ship it from the "
+                     << "Serial numbers menu instead.\n";
+                return false;
+            }
+
+            hot[idx].quantity += amount;
+            postMovement(itemId, amount, StockReason::Adjustment, reference, hot[idx].price);
+            if (!idempotencyKey.empty()) {
+                applied.record(idempotencyKey, itemId, hot[idx].quantity);
+            }
             
             // Stock negative bhayeko kura user lai inform garcha
-            if (item->quantity < 0) {
-                cout << "Warning: " << item->name << " now has negative stock! (" 
-                     << item->quantity << ")\n";
+            if (hot[idx].quantity < 0) {
+                cout << "Warning: " << cold[idx].name << " now has negative stock! (" 
+                     << hot[idx].quantity << ")\n";
             }
+            return true;
         } else {
             cout << "Couldn't find item with ID " << itemId << "\n";
+            return false;
+        }
+    }
+
+    // "1000-1999" jasto numeric range ho ki check garcha
+    static bool parseSerialRange(const string& spec, uint64_t& first, uint64_t& last) {
+        size_t dash = spec.find('-');
+        if (dash == string::npos) return false;
+        return SerialSet::parseNumeric(spec.substr(0, dash), first)
+            && SerialSet::parseNumeric(spec.substr(dash + 1), last)
+            && first <= last;
+    }
+
+    // Euta serial wa "first-last" range receive garcha, stock pani tyati nai badhcha
+    void receiveSerials(int itemId, const string& spec) {
+        size_t idx = findItem(itemId);
+        if (idx == npos) {
+            cout << "Couldn't find item with ID " << itemId << "\n";
+            return;
+        }
+
+        SerialSet& set = serials[itemId];
+        uint64_t first, last;
+        size_t added;
+        if (parseSerialRange(spec, first, last)) {
+            if (last - first >= SerialSet::MAX_RANGE) {
+                cout << "Error: Please receive at most " << SerialSet::MAX_RANGE << " serials at a time!\n";
+                return;
+            }
+            added = set.insertRange(first, last);
+        } else {
+            added = set.insert(spec) ? 1 : 0;
+        }
+
+        if (added == 0) {
+            cout << "Those serial numbers are already in stock.\n";
+            return;
+        }
+        hot[idx].quantity += static_cast<int>(added);
+        postMovement(itemId, static_cast<int>(added), StockReason::Receipt, "serial " + spec, hot[idx].price);
+        cout << "Received " << added << " serial number(s) for " << cold[idx].name << "\n";
+    }
+
+    // Euta serial wa range pathaucha - stock ma bhayeka matra, stock tyati nai ghatcha
+    void shipSerials(int itemId, const string& spec) {
+        size_t idx = findItem(itemId);
+        auto found = serials.find(itemId);
+        if (idx == npos || found == serials.end()) {
+            cout << "No serial numbers on record for item ID " << itemId << "\n";
+            return;
+        }
+
+        uint64_t first, last;
+        size_t shipped;
+        if (parseSerialRange(spec, first, last)) {
+            if (last - first >= SerialSet::MAX_RANGE) {
+                cout << "Error: Please ship at most " << SerialSet::MAX_RANGE << " serials at a time!\n";
+                return;
+            }
+            shipped = found->second.eraseRange(first, last);
+        } else {
+            shipped = found->second.erase(spec) ? 1 : 0;
+        }
+
+        if (shipped == 0) {
+            cout << "None of those serial numbers are in stock.\n";
+            return;
+        }
+        hot[idx].quantity -= static_cast<int>(shipped);
+        postMovement(itemId, -static_cast<int>(shipped), StockReason::Shipment, "serial " + spec, hot[idx].price);
+        cout << "Shipped " << shipped << " serial number(s) of " << cold[idx].name << "\n";
+
+        if (hot[idx].quantity < 0) {
+            cout << "Warning: " << cold[idx].name << " now has negative stock! ("
+                 << hot[idx].quantity << ")\n";
+        }
+    }
+
+    // Serial number stock ma cha ki chaina
+    bool hasSerial(int itemId, const string& serial) const {
+        auto found = serials.find(itemId);
+        return found != serials.end() && found->second.contains(serial);
+    }
+
+    // Kit ma component thapcha wa tyasko qty badlcha
+    bool defineKitComponent(int kitId, int componentId, int qty) {
+        if (findItem(kitId) == npos || findItem(componentId) == npos) {
+            cout << "Error: Both the kit and the component must be existing items!\n";
+            return false;
+        }
+        if (qty <= 0) {
+            cout << "Error: A component needs a positive quantity!\n";
+            return false;
+        }
+        if (!bom.setComponent(kitId, componentId, qty)) {
+            cout << "Error: That would make the kit contain itself!\n";
+            return false;
+        }
+        refreshBuildable(kitId);
+        return true;
+    }
+
+    // Component haru khapayera kit banaucha - sabai component pugena bhane kehi pani gardaina
+    bool buildKit(int kitId, int count) {
+        size_t kitIdx = findItem(kitId);
+        if (kitIdx == npos || !bom.isKit(kitId)) {
+            cout << "Item ID " << kitId << " is not a kit.\n";
+            return false;
+        }
+        if (count <= 0 || count > buildable[kitId]) {
+            cout << "Not enough components - you can build at most " << buildable[kitId] << ".\n";
+            return false;
+        }
+
+        // Kit lai component ko khapayeko cost ma receive garcha (sale price ma hoina)
+        string reference = "build " + to_string(count) + " x " + to_string(kitId);
+        CostSet used;
+        for (const auto& component : bom.componentsOf(kitId)) {
+            CostSet cost = applyMovement(findItem(component.first), -component.second * count,
+                                         StockReason::Assembly, reference);
+            used.fifo += cost.fifo;
+            used.lifo += cost.lifo;
+            used.average += cost.average;
+        }
+        CostSet perKit;
+        perKit.fifo = used.fifo / count;
+        perKit.lifo = used.lifo / count;
+        perKit.average = used.average / count;
+        applyMovement(kitIdx, count, StockReason::Assembly, reference, perKit);
+        cout << "Built " << count << " x " << cold[kitIdx].name << "\n";
+        return true;
+    }
+
+    // Kit kholera component haru stock ma firta halcha
+    bool unbuildKit(int kitId, int count) {
+        size_t kitIdx = findItem(kitId);
+        if (kitIdx == npos || !bom.isKit(kitId)) {
+            cout << "Item ID " << kitId << " is not a kit.\n";
+            return false;
+        }
+        if (count <= 0 || count > hot[kitIdx].quantity) {
+            cout << "Only " << hot[kitIdx].quantity << " kit(s) in stock to take apart.\n";
+            return false;
+        }
+
+        // Kit jun cost ma cha, tyo cost component haru ma bandcha -
+        // har component ko ahile ko average cost anusar bhag (sabai 0 bhaye qty anusar)
+        string reference = "unbuild " + to_string(count) + " x " + to_string(kitId);
+        CostSet carried = applyMovement(kitIdx, -count, StockReason::Disassembly, reference);
+
+        const BillOfMaterials::ComponentList& list = bom.componentsOf(kitId);
+        vector<double> weights;
+        double totalWeight = 0;
+        for (const auto& component : list) {
+            auto found = valuations.find(component.first);
+            double unit = found != valuations.end() ? found->second.averageUnitCost() : 0;
+            weights.push_back(component.second * unit);
+            totalWeight += weights.back();
+        }
+        if (totalWeight <= 0) {
+            totalWeight = 0;
+            for (size_t c = 0; c < list.size(); ++c) {
+                weights[c] = list[c].second;
+                totalWeight += weights[c];
+            }
+        }
+
+        for (size_t c = 0; c < list.size(); ++c) {
+            int qty = list[c].second * count;
+            double share = weights[c] / totalWeight / qty;
+            CostSet unitCost;
+            unitCost.fifo = carried.fifo * share;
+            unitCost.lifo = carried.lifo * share;
+            unitCost.average = carried.average * share;
+            applyMovement(findItem(list[c].first), qty, StockReason::Disassembly, reference, unitCost);
+        }
+        cout << "Took apart " << count << " x " << cold[kitIdx].name << "\n";
+        return true;
+    }
+
+    // Kit ko component, leaf samma kholeko list ra kati banna sakcha dekhaucha
+    void showKit(int kitId) const {
+        size_t kitIdx = findItem(kitId);
+        if (kitIdx == npos || !bom.isKit(kitId)) {
+            cout << "Item ID " << kitId << " is not a kit.\n";
+            return;
+        }
+
+        auto nameOf = [this](int id) {
+            size_t idx = findItem(id);
+            return idx != npos ? cold[idx].name : string("?");
+        };
+
+        cout << "\n=== KIT: " << cold[kitIdx].name << " ===\n";
+        cout << "Components:\n";
+        for (const auto& component : bom.componentsOf(kitId)) {
+            cout << "  " << component.second << " x " << nameOf(component.first)
+                 << " (ID: " << component.first << ")\n";
+        }
+        cout << "Fully exploded:\n";
+        for (const auto& leaf : bom.explode(kitId)) {
+            cout << "  " << leaf.second << " x " << nameOf(leaf.first)
+                 << " (ID: " << leaf.first << ")\n";
+        }
+        auto found = buildable.find(kitId);
+        cout << "In stock: " << hot[kitIdx].quantity
+             << ", can build: " << (found != buildable.end() ? found->second : 0) << "\n";
+    }
+
+    // Expiry bhayeko lot ko roop ma stock receive garcha
+    bool receiveLot(int itemId, int qty, const string& lotCode, int daysToExpiry,
+                    const string& idempotencyKey = "", const string& reference = "") {
+        if (qty <= 0) {
+            cout << "Error: A lot needs a positive quantity!\n";
+            return false;
+        }
+        if (daysToExpiry < 0 || daysToExpiry > MAX_EXPIRY_DAYS) {
+            cout << "Error: Days until expiry must be between 0 and " << MAX_EXPIRY_DAYS << "!\n";
+            return false;
+        }
+        if (!updateStock(itemId, qty, idempotencyKey, reference)) {
+            return false;
+        }
+        lots.receive(itemId, lotCode, time(nullptr) + static_cast<time_t>(daysToExpiry) * SECONDS_PER_DAY, qty);
+        return true;
+    }
+
+    // Aaja dekhi N din bhitra expire hune lot haru dekhaucha
+    void showExpiringLots(int days) const {
+        days = max(0, min(days, MAX_EXPIRY_DAYS));
+        cout << "\n=== LOTS EXPIRING WITHIN " << days << " DAYS ===\n";
+        cout << left << setw(6) << "ID"
+             << setw(25) << "PRODUCT NAME"
+             << setw(14) << "LOT"
+             << setw(8) << "QTY"
+             << "EXPIRES\n";
+        cout << string(65, '-') << "\n";
+
+        int count = 0;
+        lots.forEachExpiringBy(time(nullptr) + static_cast<time_t>(days) * SECONDS_PER_DAY,
+            [&](int itemId, const LotPick& lot) {
+                size_t idx = findItem(itemId);
+                string name = idx != npos ? cold[idx].name : "?";
+                cout << left << setw(6) << itemId
+                     << setw(25) << (name.length() > 22 ? name.substr(0, 19) + "..." : name)
+                     << setw(14) << lot.lotCode
+                     << setw(8) << lot.qty
+                     << formatDate(lot.expiry) << "\n";
+                ++count;
+            });
+
+        if (count == 0) {
+            cout << "Nothing expires in that window.\n";
+        }
+        cout << string(65, '=') << "\n\n";
+    }
+
+    // Ledger bata feri jodeko balance ra item ko quantity milcha ki check garcha
+    // (hatayeko saman ko balance 0 hunuparcha)
+    bool verifyLedger() const {
+        unordered_map<int, long long> sums = ledger.recompute();
+        int mismatches = 0;
+
+        for (const auto& entry : sums) {
+            size_t idx = findItem(entry.first);
+            long long expected = idx != npos ? hot[idx].quantity : 0;
+            if (entry.second != expected || ledger.balance(entry.first) != expected) {
+                cout << "Mismatch for ID " << entry.first << ": ledger says " << entry.second
+                     << ", stock says " << expected << "\n";
+                ++mismatches;
+            }
+        }
+        for (const auto& item : hot) {
+            if (sums.find(item.id) == sums.end() && item.quantity != 0) {
+                cout << "Mismatch for ID " << item.id << ": no postings, stock says "
+                     << item.quantity << "\n";
+                ++mismatches;
+            }
+        }
+
+        cout << "Checked " << ledger.size() << " postings across " << sums.size() << " items - ";
+        if (mismatches == 0) {
+            cout << "ledger matches stock.\n";
+        } else {
+            cout << mismatches << " mismatch(es) found!\n";
+        }
+        return mismatches == 0;
+    }
+
+    // Euta saman ko stock movement history dekhaucha
+    void showLedger(int id) const {
+        if (!ledger.contains(id)) {
+            cout << "Couldn't find item with ID " << id << "\n";
+            return;
+        }
+        cout << "\n=== STOCK MOVEMENTS FOR ID " << id << " ===\n";
+        ledger.printHistory(id);
+        cout << "Balance: " << ledger.balance(id) << "\n";
+    }
+
+    // Bikri history bata har item ko safety stock ra reorder point suggest garcha
+    void suggestSafetyStock(double meanLeadDays, double serviceLevel) const {
+        if (hot.empty()) {
+            cout << "The inventory is currently empty.\n";
+            return;
+        }
+
+        unordered_map<int, vector<int>> demand = ledger.dailyDemand(time(nullptr));
+        vector<pair<int, vector<int>>> histories;
+        for (const auto& item : hot) {
+            histories.push_back({item.id, demand[item.id]});
+        }
+        vector<SafetyStockResult> results =
+            SafetyStockSimulator(meanLeadDays, serviceLevel).run(histories);
+
+        cout << "\n=== SAFETY STOCK SUGGESTIONS ===\n";
+        cout << left << setw(6) << "ID"
+             << setw(25) << "PRODUCT NAME"
+             << setw(12) << "PER DAY"
+             << setw(14) << "SAFETY STOCK"
+             << "REORDER AT\n";
+        cout << string(70, '-') << "\n";
+        for (const auto& result : results) {
+            size_t idx = findItem(result.itemId);
+            const string& name = cold[idx].name;
+            cout << left << setw(6) << result.itemId
+                 << setw(25) << (name.length() > 22 ? name.substr(0, 19) + "..." : name)
+                 << fixed << setprecision(2) << setw(12) << result.meanDailyDemand
+                 << setprecision(0) << setw(14) << ceil(result.safetyStock)
+                 << ceil(result.reorderPoint) << "\n";
+        }
+        cout << string(70, '=') << "\n\n";
+    }
+
+    // Pura catalog ko EOQ/min-max plan banaucha ra purchase order proposal file lekhcha
+    void writeReplenishmentPlan(const string& path, double leadDays, double orderCost,
+                                double holdingRate) const {
+        if (hot.empty()) {
+            cout << "The inventory is currently empty.\n";
+            return;
+        }
+
+        // Hot array bata column haru taancha
+        unordered_map<int, vector<int>> demand = ledger.dailyDemand(time(nullptr));
+        vector<int> quantity(hot.size());
+        vector<double> price(hot.size()), rate(hot.size());
+        for (size_t i = 0; i < hot.size(); ++i) {
+            quantity[i] = hot[i].quantity;
+            price[i] = hot[i].price;
+            const vector<int>& days = demand[hot[i].id];
+            double total = 0;
+            for (int d : days) total += d;
+            rate[i] = days.empty() ? 0 : total / days.size();
+        }
+
+        ReplenishmentPlan plan = planReplenishment(quantity, price, rate, leadDays,
+                                                   orderCost, holdingRate);
+
+        ofstream out(path);
+        if (!out) {
+            cout << "Error: Couldn't open " << path << " for writing!\n";
+            return;
+        }
+        out << "id,name,on_hand,eoq,min,max,order_qty,est_cost\n";
+        int lines = 0, unpriced = 0;
+        for (size_t i = 0; i < hot.size(); ++i) {
+            if (price[i] <= 0) ++unpriced;
+            if (plan.orderQty[i] <= 0) continue;
+            out << hot[i].id << "," << csvQuote(cold[i].name) << "," << quantity[i]
+                << fixed << setprecision(2)
+                << "," << plan.eoq[i] << "," << plan.minLevel[i] << "," << plan.maxLevel[i]
+                << "," << plan.orderQty[i] << "," << plan.orderQty[i] * price[i] << "\n";
+            ++lines;
+        }
+        cout << "Wrote " << lines << " order line(s) for " << hot.size()
+             << " items to " << path << "\n";
+        if (unpriced > 0) {
+            cout << "Skipped " << unpriced << " item(s) with no price - EOQ needs a price.\n";
         }
     }
 
+    // Inventory ko stats ra sabai bhanda dherai lookup/update hune item haru dekhaucha
+    void showStats() const {
+        cout << "\n=== INVENTORY STATS ===\n";
+        cout << "Items:            " << hot.size() << "\n";
+        cout << "Ledger postings:  " << ledger.size() << "\n";
+        cout << "Lookups/updates:  " << accessCount << "\n";
+
+        vector<HeavyHitters::Entry> top = hotItems.top(10);
+        if (top.empty()) {
+            cout << "\nNo traffic recorded yet.\n";
+            return;
+        }
+
+        cout << "\nHottest items:\n";
+        cout << left << setw(6) << "ID" << setw(25) << "PRODUCT NAME"
+             << setw(10) << "HITS" << setw(10) << "AT LEAST" << "SKETCH\n";
+        cout << string(60, '-') << "\n";
+        for (const auto& entry : top) {
+            size_t idx = findItem(entry.key);
+            string name = idx != npos ? cold[idx].name : "(removed)";
+            cout << left << setw(6) << entry.key
+                 << setw(25) << (name.length() > 22 ? name.substr(0, 19) + "..." : name)
+                 << setw(10) << entry.count
+                 << setw(10) << entry.count - entry.error
+                 << accessSketch.estimate(entry.key) << "\n";
+        }
+        cout << string(60, '=') << "\n\n";
+    }
+
+    // Sabai bhanda chado bikne top K item haru dekhaucha
+    void showFastestMovers(size_t k) const {
+        time_t now = time(nullptr);
+        vector<pair<double, size_t>> rates;   // (per day, index)
+        for (size_t i = 0; i < hot.size(); ++i) {
+            double rate = velocity[i].perDay(now);
+            if (rate > 0) rates.push_back({rate, i});
+        }
+        if (rates.empty()) {
+            cout << "Nothing has been sold yet.\n";
+            return;
+        }
+
+        k = min(k, rates.size());
+        partial_sort(rates.begin(), rates.begin() + k, rates.end(),
+            [](const pair<double, size_t>& a, const pair<double, size_t>& b) {
+                return a.first > b.first;
+            });
+
+        cout << "\n=== TOP " << k << " FASTEST MOVERS ===\n";
+        cout << left << setw(6) << "ID" << setw(25) << "PRODUCT NAME" << "UNITS/DAY\n";
+        cout << string(45, '-') << "\n";
+        for (size_t r = 0; r < k; ++r) {
+            size_t i = rates[r].second;
+            cout << left << setw(6) << hot[i].id
+                 << setw(25) << (cold[i].name.length() > 22 ? cold[i].name.substr(0, 19) + "..." : cold[i].name)
+                 << fixed << setprecision(2) << rates[r].first << "\n";
+        }
+        cout << string(45, '=') << "\n\n";
+    }
+
+    // ABC class feri nikalcha ra class anusar kati item ra value cha dekhaucha
+    void showAbcSummary() {
+        if (hot.empty()) {
+            cout << "The inventory is currently empty.\n";
+            return;
+        }
+        classifyAbc();
+
+        map<char, pair<int, double>> summary;   // Class -> (item count, value)
+        for (size_t i = 0; i < hot.size(); ++i) {
+            summary[abcClass[i]].first++;
+            summary[abcClass[i]].second += max(hot[i].quantity, 0) * hot[i].price;
+        }
+
+        cout << "\n=== ABC CLASSIFICATION ===\n";
+        cout << left << setw(8) << "CLASS" << setw(8) << "ITEMS" << setw(16) << "VALUE" << "SHARE\n";
+        cout << string(40, '-') << "\n";
+        for (const auto& entry : summary) {
+            double share = abcBaseValue > 0 ? entry.second.second / abcBaseValue * 100 : 0;
+            cout << left << setw(8) << entry.first << setw(8) << entry.second.first
+                 << "$" << fixed << setprecision(2) << setw(15) << entry.second.second
+                 << setprecision(1) << share << "%\n";
+        }
+        cout << string(40, '=') << "\n\n";
+    }
+
+    // Har item ko FIFO/LIFO/average value ra jamma value dekhaucha
+    // (jamma value maintained aggregate bata - history replay gardaina)
+    void showValuation() const {
+        if (hot.empty()) {
+            cout << "The inventory is currently empty.\n";
+            return;
+        }
+
+        cout << "\n=== INVENTORY VALUATION ===\n";
+        cout << left << setw(6) << "ID"
+             << setw(25) << "PRODUCT NAME"
+             << setw(14) << "FIFO"
+             << setw(14) << "LIFO"
+             << "AVERAGE\n";
+        cout << string(72, '-') << "\n";
+
+        for (size_t i = 0; i < hot.size(); ++i) {
+            auto found = valuations.find(hot[i].id);
+            if (found == valuations.end()) continue;
+            const ItemValuation& v = found->second;
+            cout << left << setw(6) << hot[i].id
+                 << setw(25) << (cold[i].name.length() > 22 ? cold[i].name.substr(0, 19) + "..." : cold[i].name)
+                 << fixed << setprecision(2)
+                 << "$" << setw(13) << v.fifoValue()
+                 << "$" << setw(13) << v.lifoValue()
+                 << "$" << v.averageValue() << "\n";
+        }
+        cout << string(72, '-') << "\n";
+        cout << left << setw(31) << "TOTAL" << fixed << setprecision(2)
+             << "$" << setw(13) << totalFifo
+             << "$" << setw(13) << totalLifo
+             << "$" << totalAverage << "\n";
+        cout << string(72, '=') << "\n\n";
+    }
+
     // Sabai saman haru dekhaune function
     void listItems() const {
-        if (items.empty()) {
+        if (hot.empty()) {
             cout << "The inventory is currently empty.\n";
             return;
         }
@@ -108,18 +1714,21 @@ public:
              << setw(25) << "PRODUCT NAME" 
              << setw(12) << "QUANTITY" 
              << setw(12) << "PRICE" 
+             << setw(7) << "CLASS"
              << "CATEGORY\n";
-        cout << string(60, '-') << "\n";
+        cout << string(67, '-') << "\n";
         
         // Sabai saman haru dekhaucha
-        for (const auto& item : items) {
+        for (size_t i = 0; i < hot.size(); ++i) {
+            Item item = itemAt(i);
             cout << left << setw(6) << item.id
                  << setw(25) << (item.name.length() > 22 ? item.name.substr(0, 19) + "..." : item.name)
                  << setw(12) << item.quantity
                  << "$" << fixed << setprecision(2) << setw(10) << item.price
+                 << setw(7) << abcClass[i]
                  << item.category << "\n";
         }
-        cout << string(60, '=') << "\n\n";
+        cout << string(67, '=') << "\n\n";
     }
 
     // Euta string arko string ma cha ki check garcha (capital small farak gardaina)
@@ -134,7 +1743,7 @@ public:
 
     // Inventory khali cha ki chaina check garcha
     bool isEmpty() const {
-        return items.empty();
+        return hot.empty();
     }
 
     // Saman haru khojne function (naam, category, or ID le)
@@ -148,26 +1757,36 @@ public:
         
         // ID le khojnu pareko ho ki check garcha
         bool isIdSearch = !searchTerm.empty() && all_of(searchTerm.begin(), searchTerm.end(), ::isdigit);
+
+        // "class:A" jasto ABC class le khojnu pareko ho ki check garcha
+        bool isClassSearch = searchTerm.size() == 7 && containsIgnoreCase(searchTerm.substr(0, 6), "class:");
+        char wantedClass = isClassSearch ? static_cast<char>(toupper(searchTerm[6])) : 0;
         
         // Sabai saman haru ma loop chalau
-        for (const auto& item : items) {
+        for (size_t i = 0; i < hot.size(); ++i) {
+            if (isClassSearch) {
+                if (abcClass[i] == wantedClass) matches.push_back(itemAt(i));
+                continue;
+            }
+
             // ID le khojnu pareko bhane tyo check garcha
-            if (isIdSearch && to_string(item.id) == searchTerm) {
-                matches.push_back(item);
+            if (isIdSearch && to_string(hot[i].id) == searchTerm) {
+                matches.push_back(itemAt(i));
+                recordAccess(hot[i].id);
                 continue;
             }
             
             // Name ra category ma khojcha
-            if (containsIgnoreCase(item.name, searchTerm) || 
-                containsIgnoreCase(item.category, searchTerm)) {
-                matches.push_back(item);
+            if (containsIgnoreCase(cold[i].name, searchTerm) || 
+                containsIgnoreCase(cold[i].category, searchTerm)) {
+                matches.push_back(itemAt(i));
             }
         }
 
         // Kati ota payeo bhanera dekhaucha
         if (matches.empty()) {
             cout << "\nNo matches found for '" << searchTerm << "'\n";
-            cout << "Try searching by product name, category, or ID\n";
+            cout << "Try searching by product name, category, ID, or class:A/B/C\n";
             return;
         }
         
@@ -178,6 +1797,7 @@ public:
                  << "\nCategory: " << item.category
                  << "\nIn stock: " << item.quantity
                  << "\nPrice: $" << fixed << setprecision(2) << item.price
+                 << "\nABC class: " << abcClass[findItem(item.id)]
                  << "\n" << string(30, '-') << "\n";
         }
     }
@@ -212,17 +1832,22 @@ int getIntegerInput(const string& prompt, int min = INT_MIN, int max = INT_MAX)
 }
 
 // User bata decimal number lini
-double getDoubleInput(const string& prompt, double min = 0.0) {
+double getDoubleInput(const string& prompt, double min = 0.0,
+                      double max = numeric_limits<double>::max()) {
     double num;
     while (true) {
         cout << prompt;
         
         if (cin >> num) {
-            if (num >= min) {
+            if (num >= min && num <= max) {
                 cin.ignore(numeric_limits<streamsize>::max(), '\n');
                 return num;
             }
-            cout << "Please enter at least " << min << ".\n";
+            if (num < min) {
+                cout << "Please enter at least " << min << ".\n";
+            } else {
+                cout << "Please enter at most " << max << ".\n";
+            }
         } else {
             cout << "Please enter a valid number.\n";
             cin.clear();
@@ -262,10 +1887,20 @@ int showMainMenu() {
          << "3. Update stock level\n"
          << "4. View all items\n"
          << "5. Search for items\n"
-         << "6. Exit\n\n";
+         << "6. Stock ledger\n"
+         << "7. Inventory valuation\n"
+         << "8. Expiring lots\n"
+         << "9. Serial numbers\n"
+         << "10. Kits\n"
+         << "11. Safety stock simulation\n"
+         << "12. Replenishment plan\n"
+         << "13. ABC classification\n"
+         << "14. Fastest movers\n"
+         << "15. Stats\n"
+         << "16. Exit\n\n";
     
     // User le select gareko option return garcha
-    return getIntegerInput("Enter your choice (1-6): ", 1, 6);
+    return getIntegerInput("Enter your choice (1-16): ", 1, 16);
 }
 
 int main() {
@@ -274,10 +1909,16 @@ int main() {
     bool keepRunning = true;
     
     // Add some sample items to start with
-    inventory.addItem("Laptop", 5, 1299.99, "Electronics");
-    inventory.addItem("Wireless Mouse", 10, 29.99, "Accessories");
-    inventory.addItem("Mechanical Keyboard", 8, 89.99, "Accessories");
+    int laptop = inventory.addItem("Laptop", 5, 1299.99, "Electronics");
+    int mouse = inventory.addItem("Wireless Mouse", 10, 29.99, "Accessories");
+    int keyboard = inventory.addItem("Mechanical Keyboard", 8, 89.99, "Accessories");
     inventory.addItem("27\" 4K Monitor", 3, 349.99, "Monitors");
+
+    // Laptop + mouse + keyboard ko bundle
+    int bundle = inventory.addItem("Laptop Starter Bundle", 0, 1399.99, "Bundles");
+    inventory.defineKitComponent(bundle, laptop, 1);
+    inventory.defineKitComponent(bundle, mouse, 1);
+    inventory.defineKitComponent(bundle, keyboard, 1);
     
     // Welcome message
     cout << "=== WELCOME TO INVENTORY MANAGER ===\n";
@@ -361,9 +2002,23 @@ int main() {
                     int id = getIntegerInput("\nWhich item ID to update? (0 to cancel) ", 0);
                     if (id != 0) {
                         cout << "\nEnter positive number to add stock, negative to remove\n";
-                        int change = getIntegerInput("How many to add/remove? ");
-                        inventory.updateStock(id, change);
-                        cout << "\n✓ Stock updated!\n";
+                        int change = getIntegerInput("How many to add/remove? ", -MAX_STOCK_CHANGE, MAX_STOCK_CHANGE);
+                        string reference = getStringInput("Reference, e.g. PO number (press Enter to skip): ", true);
+                        string key = getStringInput("One-time scan ID, blocks retries (press Enter to skip): ", true);
+                        string lotCode;
+                        if (change > 0) {
+                            lotCode = getStringInput("Lot code (press Enter if not tracked): ", true);
+                        }
+                        bool updated;
+                        if (!lotCode.empty()) {
+                            int days = getIntegerInput("Days until expiry: ", 0, MAX_EXPIRY_DAYS);
+                            updated = inventory.receiveLot(id, change, lotCode, days, key, reference);
+                        } else {
+                            updated = inventory.updateStock(id, change, key, reference);
+                        }
+                        if (updated) {
+                            cout << "\n✓ Stock updated!\n";
+                        }
                     }
                 }
                 
@@ -396,7 +2051,153 @@ int main() {
                 break;
             }
             
-            case 6:  // Exit
+            case 6: {  // Stock ledger
+                clearScreen();
+                cout << "\n--- STOCK LEDGER ---\n\n";
+
+                inventory.verifyLedger();
+
+                int id = getIntegerInput("\nShow movements for item ID (0 to skip): ", 0);
+                if (id != 0) {
+                    inventory.showLedger(id);
+                }
+
+                cout << "\nPress Enter to continue...";
+                cin.ignore();
+                break;
+            }
+
+            case 7:  // Valuation
+                clearScreen();
+                cout << "\n--- INVENTORY VALUATION ---\n\n";
+                inventory.showValuation();
+                cout << "Press Enter to go back...";
+                cin.ignore();
+                break;
+
+            case 8: {  // Expiring lots
+                clearScreen();
+                cout << "\n--- EXPIRING LOTS ---\n\n";
+
+                int days = getIntegerInput("Show lots expiring within how many days? ", 0, MAX_EXPIRY_DAYS);
+                inventory.showExpiringLots(days);
+
+                cout << "Press Enter to go back...";
+                cin.ignore();
+                break;
+            }
+
+            case 9: {  // Serial numbers
+                clearScreen();
+                cout << "\n--- SERIAL NUMBERS ---\n\n";
+
+                int id = getIntegerInput("Which item ID? (0 to cancel) ", 0);
+                if (id != 0) {
+                    cout << "\n1. Receive  2. Ship  3. Check\n";
+                    int action = getIntegerInput("What do you want to do? ", 1, 3);
+                    string spec = getStringInput("Serial number (or range like 1000-1999): ");
+
+                    if (action == 1) {
+                        inventory.receiveSerials(id, spec);
+                    } else if (action == 2) {
+                        inventory.shipSerials(id, spec);
+                    } else {
+                        cout << "Serial " << spec << (inventory.hasSerial(id, spec) ? " is" : " is NOT")
+                             << " in stock.\n";
+                    }
+                }
+
+                cout << "\nPress Enter to continue...";
+                cin.ignore();
+                break;
+            }
+
+            case 10: {  // Kits
+                clearScreen();
+                cout << "\n--- KITS ---\n\n";
+
+                int id = getIntegerInput("Which kit item ID? (0 to cancel) ", 0);
+                if (id != 0) {
+                    cout << "\n1. Show  2. Add component  3. Build  4. Take apart\n";
+                    int action = getIntegerInput("What do you want to do? ", 1, 4);
+
+                    if (action == 1) {
+                        inventory.showKit(id);
+                    } else if (action == 2) {
+                        int componentId = getIntegerInput("Component item ID: ", 1);
+                        int qty = getIntegerInput("How many per kit? ", 1);
+                        if (inventory.defineKitComponent(id, componentId, qty)) {
+                            cout << "\n✓ Component added!\n";
+                        }
+                    } else if (action == 3) {
+                        inventory.buildKit(id, getIntegerInput("How many to build? ", 1));
+                    } else {
+                        inventory.unbuildKit(id, getIntegerInput("How many to take apart? ", 1));
+                    }
+                }
+
+                cout << "\nPress Enter to continue...";
+                cin.ignore();
+                break;
+            }
+
+            case 11: {  // Safety stock simulation
+                clearScreen();
+                cout << "\n--- SAFETY STOCK SIMULATION ---\n\n";
+
+                double leadDays = getDoubleInput("Average supplier lead time (days): ", 1.0, MAX_LEAD_DAYS);
+                int service = getIntegerInput("Target service level % (50-99): ", 50, 99);
+                inventory.suggestSafetyStock(leadDays, service / 100.0);
+
+                cout << "Press Enter to go back...";
+                cin.ignore();
+                break;
+            }
+
+            case 12: {  // Replenishment plan
+                clearScreen();
+                cout << "\n--- REPLENISHMENT PLAN ---\n\n";
+
+                double leadDays = getDoubleInput("Average supplier lead time (days): ", 1.0, MAX_LEAD_DAYS);
+                double orderCost = getDoubleInput("Cost of placing one order: $");
+                int holding = getIntegerInput("Yearly holding cost (% of price): ", 1, 100);
+                inventory.writeReplenishmentPlan("purchase_order_proposal.csv", leadDays,
+                                                 orderCost, holding / 100.0);
+
+                cout << "\nPress Enter to continue...";
+                cin.ignore();
+                break;
+            }
+
+            case 13:  // ABC classification
+                clearScreen();
+                cout << "\n--- ABC CLASSIFICATION ---\n\n";
+                inventory.showAbcSummary();
+                cout << "Press Enter to go back...";
+                cin.ignore();
+                break;
+
+            case 14: {  // Fastest movers
+                clearScreen();
+                cout << "\n--- FASTEST MOVERS ---\n\n";
+
+                int k = getIntegerInput("How many items to show? ", 1);
+                inventory.showFastestMovers(k);
+
+                cout << "Press Enter to go back...";
+                cin.ignore();
+                break;
+            }
+
+            case 15:  // Stats
+                clearScreen();
+                cout << "\n--- STATS ---\n\n";
+                inventory.showStats();
+                cout << "Press Enter to go back...";
+                cin.ignore();
+                break;
+
+            case 16:  // Exit
                 clearScreen();
                 cout << "\n=== THANKS FOR USING INVENTORY MANAGER! ===\n\n";
                 cout << "Your inventory has been saved.\n";